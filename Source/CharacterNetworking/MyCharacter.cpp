@@ -3,6 +3,8 @@
 
 #include "MyCharacter.h"
 #include "MyCharacterMovementComponent.h"
+#include "ECustomMovementMode.h"
+#include "Net/UnrealNetwork.h"
 
 // Sets default values
 AMyCharacter::AMyCharacter(const class FObjectInitializer& ObjectInitializer) :
@@ -20,6 +22,42 @@ void AMyCharacter::BeginPlay()
 	
 }
 
+void AMyCharacter::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Use the quantization levels configured on ReplicatedMovement. Clients need them before the first update is received
+	MyReplicatedMovement.Movement = GetReplicatedMovement();
+}
+
+void AMyCharacter::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
+{
+	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
+
+	// MyReplicatedMovement is sent in place of the engine's ReplicatedMovement, using the same condition and notify policy
+	DISABLE_REPLICATED_PRIVATE_PROPERTY(AActor, ReplicatedMovement);
+	DOREPLIFETIME_CONDITION_NOTIFY(AMyCharacter, MyReplicatedMovement, COND_SimulatedOrPhysics, REPNOTIFY_Always);
+}
+
+void AMyCharacter::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	// Super gathers the current movement into ReplicatedMovement
+	Super::PreReplication(ChangedPropertyTracker);
+
+	MyReplicatedMovement.Movement = GetReplicatedMovement();
+
+	UMyCharacterMovementComponent* movementComponent = GetMyMovementComponent();
+	MyReplicatedMovement.bWallRunning = movementComponent != nullptr && movementComponent->IsCustomMovementMode(ECustomMovementMode::CMOVE_WallRunning);
+
+	DOREPLIFETIME_ACTIVE_OVERRIDE(AMyCharacter, MyReplicatedMovement, IsReplicatingMovement());
+}
+
+void AMyCharacter::OnRep_MyReplicatedMovement()
+{
+	SetReplicatedMovement(MyReplicatedMovement.Movement);
+	OnRep_ReplicatedMovement();
+}
+
 // Called every frame
 void AMyCharacter::Tick(float DeltaTime)
 {
@@ -4,6 +4,7 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Character.h"
+#include "MyRepMovement.h"
 #include "MyCharacter.generated.h"
 
 class UMyCharacterMovementComponent;
@@ -21,7 +22,20 @@ protected:
 	// Called when the game starts or when spawned
 	virtual void BeginPlay() override;
 
+private:
+	// Replicated instead of the engine's ReplicatedMovement so that a compact encoding can be used while wall running
+	UPROPERTY(ReplicatedUsing = OnRep_MyReplicatedMovement)
+	FMyRepMovement MyReplicatedMovement;
+
+	// Passes the received movement on to the engine's replicated movement handling
+	UFUNCTION()
+	void OnRep_MyReplicatedMovement();
+
 public:	
+	virtual void PostInitProperties() override;
+	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
 	// Called every frame
 	virtual void Tick(float DeltaTime) override;
 
@@ -20,6 +20,20 @@ FNetworkPredictionData_Client* UMyCharacterMovementComponent::GetPredictionData_
 	return ClientPredictionData;
 }
 
+float UMyCharacterMovementComponent::GetClientNetSendDeltaTime(const APlayerController* PC, const FNetworkPredictionData_Client_Character* ClientData, const FSavedMovePtr& NewMove) const
+{
+	const float netSendDeltaTime = Super::GetClientNetSendDeltaTime(PC, ClientData, NewMove);
+
+	// Lower the send rate while the server can predict our movement. As soon as input or the movement mode changes
+	// IsSteadyStateMove will return false and moves will be sent at the full rate again
+	if (bThrottleSteadyNetSends && IsSteadyStateMove(PC, ClientData, NewMove))
+	{
+		return FMath::Max(netSendDeltaTime, 1.0f / SteadyNetSendRate);
+	}
+
+	return netSendDeltaTime;
+}
+
 void UMyCharacterMovementComponent::SetSprinting(bool sprinting)
 {
 	SprintKeyDown = sprinting;
@@ -156,20 +170,94 @@ void UMyCharacterMovementComponent::OnActorHit(AActor* SelfActor, AActor* OtherA
 	if (IsFalling() == false)
 		return;
 
-	// Make sure the surface can be wall ran based on the angle of the surface that we hit
-	if (CanSurfaceBeWallRan(Hit.ImpactNormal) == false)
+	// Don't check the wall yet. A character scraping a corner or several walls can be hit many times in a single move, so the hits
+	// are collected here and the best wall is checked once the move has finished (see PerformMovement). Repeated hits on the same
+	// wall are only stored once
+	const FVector& surfaceNormal = Hit.ImpactNormal;
+	if (WallRunCandidateNormals.ContainsByPredicate([&](const FVector& normal) { return normal.Equals(surfaceNormal, 0.01f); }) == false)
+	{
+		WallRunCandidateNormals.Add(surfaceNormal);
+	}
+}
+
+void UMyCharacterMovementComponent::BeginWallRunFromCandidates(const FVector& move_velocity)
+{
+	// The state may have changed since the hits were collected (e.g. we landed later in the same move)
+	if (IsCustomMovementMode(ECustomMovementMode::CMOVE_WallRunning) || IsFalling() == false)
+	{
+		WallRunCandidateNormals.Reset();
+		return;
+	}
+
+	// Score every wall that can be wall ran in a single pass. Prefer walls that run alongside our movement, since a wall we ran into
+	// head on (like the end wall of a corner) doesn't have a clear side to run along. The score only orders the walls, so any wall
+	// that can be wall ran may still be picked if it's the only one we hit
+	const FVector2D moveDirection = FVector2D(move_velocity).GetSafeNormal();
+	int32 bestCandidate = INDEX_NONE;
+	float bestScore = -MAX_FLT;
+	for (int32 i = 0; i < WallRunCandidateNormals.Num(); ++i)
+	{
+		const FVector& surfaceNormal = WallRunCandidateNormals[i];
+		if (CanSurfaceBeWallRan(surfaceNormal) == false)
+			continue;
+
+		const float score = 1.0f - FMath::Abs(FVector2D::DotProduct(FVector2D(surfaceNormal).GetSafeNormal(), moveDirection));
+		if (score > bestScore)
+		{
+			bestScore = score;
+			bestCandidate = i;
+		}
+	}
+
+	if (bestCandidate == INDEX_NONE)
+	{
+		WallRunCandidateNormals.Reset();
 		return;
+	}
 
-	// Update the wall run direction and side
-	FindWallRunDirectionAndSide(Hit.ImpactNormal, WallRunDirection, WallRunSide);
+	// IsNextToWall traces along the current wall run direction and side, so set them for the best wall but put the old values back
+	// if we're not next to it
+	const FVector previousWallRunDirection = WallRunDirection;
+	const EWallRunSide previousWallRunSide = WallRunSide;
+	FindWallRunDirectionAndSide(WallRunCandidateNormals[bestCandidate], WallRunDirection, WallRunSide);
+	WallRunCandidateNormals.Reset();
 
-	// Make sure we're next to a wall
+	// Make sure we're next to a wall. This is the only line trace we do no matter how many walls were hit
 	if (IsNextToWall() == false)
+	{
+		WallRunDirection = previousWallRunDirection;
+		WallRunSide = previousWallRunSide;
 		return;
+	}
 
 	BeginWallRun();
 }
 
+bool UMyCharacterMovementComponent::IsSteadyStateMove(const APlayerController* PC, const FNetworkPredictionData_Client_Character* ClientData, const FSavedMovePtr& NewMove) const
+{
+	// Only wall running and sprinting are throttled since they're fully predictable from the starting state
+	if (IsCustomMovementMode(ECustomMovementMode::CMOVE_WallRunning) == false && (IsMovingOnGround() == false || WantsToSprint == false))
+		return false;
+
+	// We need an acknowledged move to compare against, otherwise the server may not know our current state yet
+	if (ClientData == nullptr || ClientData->LastAckedMove.IsValid() == false || NewMove.IsValid() == false)
+		return false;
+
+	// Send at full rate if the compressed flags or movement mode changed since the last acknowledged move
+	if (NewMove->IsImportantMove(ClientData->LastAckedMove))
+		return false;
+
+	// The engine tolerates small acceleration changes in IsImportantMove, but any change in input means the move is no longer steady
+	if (NewMove->Acceleration.Equals(ClientData->LastAckedMove->Acceleration, KINDA_SMALL_NUMBER) == false)
+		return false;
+
+	// Aiming is input too. Like the engine's stationary throttle, only hold back moves whose control rotation hasn't changed
+	if (NewMove->IsMatchingStartControlRotation(PC) == false)
+		return false;
+
+	return true;
+}
+
 void UMyCharacterMovementComponent::BeginPlay()
 {
 	Super::BeginPlay();
@@ -193,6 +281,24 @@ void UMyCharacterMovementComponent::OnComponentDestroyed(bool bDestroyingHierarc
 	Super::OnComponentDestroyed(bDestroyingHierarchy);
 }
 
+void UMyCharacterMovementComponent::PerformMovement(float DeltaTime)
+{
+	// Only hits that happen during this move should be considered for a wall run. Anything hit in between moves (e.g. being pushed
+	// by another character or a moving platform) may no longer be next to us
+	WallRunCandidateNormals.Reset();
+	const FVector moveVelocity = Velocity;
+
+	Super::PerformMovement(DeltaTime);
+
+	// Blocking hits are deferred until the move's scoped movement update closes, which happens before Super returns, so this
+	// is the first point where all of the move's hits have been collected. PerformMovement runs for every move on both the
+	// autonomous proxy and the server (including replayed moves), so the wall run still begins as part of the move it was hit in
+	if (WallRunCandidateNormals.Num() > 0)
+	{
+		BeginWallRunFromCandidates(moveVelocity);
+	}
+}
+
 void UMyCharacterMovementComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
 	// Peform local only checks
@@ -37,6 +37,12 @@ private:
 	// The player's velocity while wall running
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "My Character Movement|Wall Running", Meta = (AllowPrivateAccess = "true"))
 	float WallRunSpeed = 625.0f;
+	// If true, the client sends moves to the server less often while its movement state and input stay unchanged
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "My Character Movement|Networking", Meta = (AllowPrivateAccess = "true"))
+	bool bThrottleSteadyNetSends = true;
+	// The rate (in updates per second) moves are sent to the server at while wall running or sprinting without any input changes
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category = "My Character Movement|Networking", Meta = (AllowPrivateAccess = "true", ClampMin = "5.0", ClampMax = "120.0", EditCondition = "bThrottleSteadyNetSends"))
+	float SteadyNetSendRate = 15.0f;
 #pragma endregion
 
 #pragma region Sprinting Functions
@@ -64,15 +70,24 @@ public:
 	// Returns true if the movement mode is custom and matches the provided custom movement mode
 	bool IsCustomMovementMode(uint8 custom_movement_mode) const;
 private:
-	// Called when the owning actor hits something (to begin the wall run)
+	// Called when the owning actor hits something (to collect walls we might begin wall running on)
 	UFUNCTION()
 	void OnActorHit(AActor* SelfActor, AActor* OtherActor, FVector NormalImpulse, const FHitResult& Hit);
+	// Begins wall running on the best wall out of all the walls hit during the last move if we're still next to it
+	void BeginWallRunFromCandidates(const FVector& move_velocity);
+#pragma endregion
+
+#pragma region Networking Functions
+private:
+	// Returns true if the new move continues a steady wall run or sprint that the server can predict from the last acknowledged move
+	bool IsSteadyStateMove(const APlayerController* PC, const FNetworkPredictionData_Client_Character* ClientData, const FSavedMovePtr& NewMove) const;
 #pragma endregion
 
 #pragma region Overrides
 protected:
 	virtual void BeginPlay() override;
 	virtual void OnComponentDestroyed(bool bDestroyingHierarchy) override;
+	virtual void PerformMovement(float DeltaTime) override;
 public:
 	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 	virtual void UpdateFromCompressedFlags(uint8 Flags) override;
@@ -83,6 +98,7 @@ public:
 	virtual float GetMaxAcceleration() const override;
 	virtual void ProcessLanded(const FHitResult& Hit, float remainingTime, int32 Iterations) override;
 	virtual FNetworkPredictionData_Client* GetPredictionData_Client() const override;
+	virtual float GetClientNetSendDeltaTime(const APlayerController* PC, const FNetworkPredictionData_Client_Character* ClientData, const FSavedMovePtr& NewMove) const override;
 #pragma endregion
 
 #pragma region Compressed Flags
@@ -98,6 +114,8 @@ private:
 	FVector WallRunDirection;
 	// The side of the wall the player is running on.
 	EWallRunSide WallRunSide;
+	// The surface normals of everything the character hit during the current move. These are the walls we might begin wall running on
+	TArray<FVector, TInlineAllocator<4>> WallRunCandidateNormals;
 #pragma endregion
 };
 
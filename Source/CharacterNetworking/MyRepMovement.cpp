@@ -0,0 +1,82 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+
+#include "MyRepMovement.h"
+
+bool FMyRepMovement::NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess)
+{
+	uint8 wallRunning = bWallRunning ? 1 : 0;
+	Ar.SerializeBits(&wallRunning, 1);
+	bWallRunning = wallRunning != 0;
+
+	// Use the engine's encoding unless we're wall running
+	if (bWallRunning == false)
+	{
+		return Movement.NetSerialize(Ar, Map, bOutSuccess);
+	}
+
+	// The location can't be derived from anything the simulated proxies know about, so it's sent as normal
+	bOutSuccess = Movement.SerializeQuantizedVector(Ar, Movement.Location, Movement.LocationQuantizationLevel);
+
+	// The character is constrained to horizontal movement while wall running, so the Z velocity is always zero. Only X and Y are
+	// sent, each with the same precision the engine uses for the configured velocity quantization level
+	const float velocityScale = Movement.VelocityQuantizationLevel == EVectorQuantization::RoundTwoDecimals ? 100.0f :
+		Movement.VelocityQuantizationLevel == EVectorQuantization::RoundOneDecimal ? 10.0f : 1.0f;
+
+	// Helper lambdas for zigzag encoding the scaled components so small negative values stay small
+	auto encodeVelocityComponent = [&](float component)
+	{
+		const int32 scaledComponent = FMath::RoundToInt(component * velocityScale);
+		return (static_cast<uint32>(scaledComponent) << 1) ^ static_cast<uint32>(scaledComponent >> 31);
+	};
+	auto decodeVelocityComponent = [&](uint32 packedComponent)
+	{
+		return (static_cast<int32>(packedComponent >> 1) ^ -static_cast<int32>(packedComponent & 1)) / velocityScale;
+	};
+
+	// Both components share a single bit count, like the engine's packed vectors
+	uint32 packedX = Ar.IsSaving() ? encodeVelocityComponent(Movement.LinearVelocity.X) : 0;
+	uint32 packedY = Ar.IsSaving() ? encodeVelocityComponent(Movement.LinearVelocity.Y) : 0;
+	uint32 componentBits = Ar.IsSaving() ? FMath::CeilLogTwo64(static_cast<uint64>(FMath::Max(packedX, packedY)) + 1) : 0;
+	Ar.SerializeInt(componentBits, 33);
+	Ar.SerializeBits(&packedX, componentBits);
+	Ar.SerializeBits(&packedY, componentBits);
+	const float velocityX = decodeVelocityComponent(packedX);
+	const float velocityY = decodeVelocityComponent(packedY);
+
+	// The character stays upright while wall running so only the yaw is sent, using the configured rotation quantization level
+	float rotationYaw = Movement.Rotation.Yaw;
+	if (Movement.RotationQuantizationLevel == ERotatorQuantization::ByteComponents)
+	{
+		uint8 compressedYaw = Ar.IsSaving() ? FRotator::CompressAxisToByte(rotationYaw) : 0;
+		Ar << compressedYaw;
+		rotationYaw = FRotator::DecompressAxisFromByte(compressedYaw);
+	}
+	else
+	{
+		uint16 compressedYaw = Ar.IsSaving() ? FRotator::CompressAxisToShort(rotationYaw) : 0;
+		Ar << compressedYaw;
+		rotationYaw = FRotator::DecompressAxisFromShort(compressedYaw);
+	}
+
+	if (Ar.IsLoading())
+	{
+		Movement.LinearVelocity = FVector(velocityX, velocityY, 0.0f);
+		Movement.Rotation = FRotator(0.0f, rotationYaw, 0.0f);
+		Movement.AngularVelocity = FVector::ZeroVector;
+		Movement.bRepPhysics = false;
+		Movement.bSimulatedPhysicSleep = false;
+	}
+
+	return true;
+}
+
+bool FMyRepMovement::operator==(const FMyRepMovement& Other) const
+{
+	return Movement == Other.Movement && bWallRunning == Other.bWallRunning;
+}
+
+bool FMyRepMovement::operator!=(const FMyRepMovement& Other) const
+{
+	return !(*this == Other);
+}
@@ -0,0 +1,41 @@
+// Fill out your copyright notice in the Description page of Project Settings.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/EngineTypes.h"
+#include "MyRepMovement.generated.h"
+
+/**
+ * Replicated movement for AMyCharacter. Wraps the engine's FRepMovement and uses a compact encoding while wall running
+ */
+USTRUCT()
+struct CHARACTERNETWORKING_API FMyRepMovement
+{
+	GENERATED_BODY()
+
+	// The movement gathered by the engine. Its quantization levels are used when serializing
+	UPROPERTY()
+	FRepMovement Movement;
+	// True if the character was wall running when the movement was gathered
+	UPROPERTY()
+	bool bWallRunning = false;
+
+	// Serializes the movement. While wall running only the location, the horizontal velocity and the yaw are sent since the
+	// character is constrained to horizontal movement
+	bool NetSerialize(FArchive& Ar, class UPackageMap* Map, bool& bOutSuccess);
+
+	bool operator==(const FMyRepMovement& Other) const;
+	bool operator!=(const FMyRepMovement& Other) const;
+};
+
+template<>
+struct TStructOpsTypeTraits<FMyRepMovement> : public TStructOpsTypeTraitsBase2<FMyRepMovement>
+{
+	enum
+	{
+		WithNetSerializer = true,
+		WithNetSharedSerialization = true,
+		WithIdenticalViaEquality = true,
+	};
+};